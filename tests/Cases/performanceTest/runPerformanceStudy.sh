@@ -15,20 +15,35 @@ if [ -e "${LOGNAME}" ]; then
     rm ${LOGNAME}
 fi
 
-if [ -e "plotPerformance.dat" ]; then
-    rm plotPerformance.dat
-fi
-
-touch ${LOGNAME}
-touch plotPerformance.dat
-
-for i in {1..30}; do
-    ../src/performanceRun.exe  >> ${LOGNAME}
-    # Store data in file to plot
-    buildUp=$(grep "Duration Build-Up:" performanceRun.log | tail -n1 | grep -Eo '[+-]?[0-9]+([.][0-9]+)?')
-    runTimes=$(grep "Duration Run-Time:" performanceRun.log | tail -n1 | grep -Eo '[+-]?[0-9]+([.][0-9]+)?')
-    echo -e "${runTimes}\t${buildUp}" >> plotPerformance.dat
+# Compare the vectorised weights with the stencil wise evaluation
+for weights in vectorised stencilWise; do
+
+    if [ "${weights}" == "vectorised" ]; then
+        foamDictionary system/WENODict -entry vectorisedWeights -set true
+        DATNAME="plotPerformance.dat"
+    else
+        foamDictionary system/WENODict -entry vectorisedWeights -set false
+        DATNAME="plotPerformanceStencilWise.dat"
+    fi
+
+    if [ -e "${DATNAME}" ]; then
+        rm ${DATNAME}
+    fi
+
+    touch ${LOGNAME}
+    touch ${DATNAME}
+
+    for i in {1..30}; do
+        ../src/performanceRun.exe  >> ${LOGNAME}
+        # Store data in file to plot
+        buildUp=$(grep "Duration Build-Up:" performanceRun.log | tail -n1 | grep -Eo '[+-]?[0-9]+([.][0-9]+)?')
+        runTimes=$(grep "Duration Run-Time:" performanceRun.log | tail -n1 | grep -Eo '[+-]?[0-9]+([.][0-9]+)?')
+        runTimesVector=$(grep "Duration Run-Time Vector:" performanceRun.log | tail -n1 | grep -Eo '[+-]?[0-9]+([.][0-9]+)?')
+        echo -e "${runTimes}\t${buildUp}\t${runTimesVector}" >> ${DATNAME}
+    done
 done
 
+foamDictionary system/WENODict -entry vectorisedWeights -remove
+
 
  